@@ -0,0 +1,101 @@
+/* --------------------------------------------------------------------------
+ * $RCSfile$
+ * $Revision$
+ * $Date$
+ * $Author$
+ * --------------------------------------------------------------------------
+ * Synopsis:
+ *
+ * Linux replacement for the pre-standard fstream.h of VisualAge C++: the
+ * classes fstream, ifstream and ofstream, derived from the streams of
+ * iostream.h.
+ *
+ * This file is part of the EA classlib package.
+ * Copyright Bernhard Bablok, 1996
+ *
+ * The EA classlib package is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You may use the classes in the package to any extend you wish. You are
+ * allowed to change and copy the source of the classes, as long as you keep
+ * the copyright notice intact and as long as you document the changes you made.
+ *
+ * You are not allowed to sell the EA classlib package or a modified version
+ * thereof, but you may charge for costs of distribution media.
+ *
+ * --------------------------------------------------------------------------
+ * Change-Log:
+ *
+ * $Log$
+ *
+ * -------------------------------------------------------------------------- */
+
+#ifndef __fstream_h
+  #define __fstream_h
+
+  #include <fstream>
+
+  #ifndef __iostream_h
+     #include <iostream.h>
+  #endif
+
+  // open and close of the file streams   --------------------------------------
+
+  #define FSTREAM_MEMBERS(stream,defaultMode)                                 \
+     public:                                                                  \
+        void open(const char* name,                                           \
+                  std::ios_base::openmode mode=(defaultMode)) {               \
+           if (mBuffer.open(name,mode|(defaultMode)))                         \
+              clear();                                                        \
+           else                                                               \
+              setstate(std::ios_base::failbit);                               \
+        }                                                                     \
+        void close() {                                                        \
+           if (!mBuffer.close())                                              \
+              setstate(std::ios_base::failbit);                               \
+        }                                                                     \
+        int is_open() const {return mBuffer.is_open();}                       \
+        std::filebuf* rdbuf() const {return (std::filebuf*) &mBuffer;}        \
+     private:                                                                 \
+        stream(const stream&);                                                \
+        stream& operator=(const stream&);                                     \
+        std::filebuf mBuffer
+
+  class fstream : public iostream {
+     public:
+        fstream() : iostream(0) {init(&mBuffer);}
+        fstream(const char* name, std::ios_base::openmode mode) :
+                                                                iostream(0) {
+           init(&mBuffer);
+           open(name,mode);
+        }
+     FSTREAM_MEMBERS(fstream,std::ios_base::openmode());
+  };
+
+  class ifstream : public istream {
+     public:
+        ifstream() : istream(0) {init(&mBuffer);}
+        ifstream(const char* name,
+                         std::ios_base::openmode mode=std::ios_base::in) :
+                                                                 istream(0) {
+           init(&mBuffer);
+           open(name,mode);
+        }
+     FSTREAM_MEMBERS(ifstream,std::ios_base::in);
+  };
+
+  class ofstream : public ostream {
+     public:
+        ofstream() : ostream(0) {init(&mBuffer);}
+        ofstream(const char* name,
+                         std::ios_base::openmode mode=std::ios_base::out) :
+                                                                 ostream(0) {
+           init(&mBuffer);
+           open(name,mode);
+        }
+     FSTREAM_MEMBERS(ofstream,std::ios_base::out);
+  };
+
+  #undef FSTREAM_MEMBERS
+#endif
@@ -0,0 +1,37 @@
+/* --------------------------------------------------------------------------
+ * $RCSfile$
+ * $Revision$
+ * $Date$
+ * $Author$
+ * --------------------------------------------------------------------------
+ * Synopsis:
+ *
+ * Linux replacement for icursor.h of the IBM Open Class collections: the
+ * macro forCursor.
+ *
+ * This file is part of the EA classlib package.
+ * Copyright Bernhard Bablok, 1996
+ *
+ * The EA classlib package is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You may use the classes in the package to any extend you wish. You are
+ * allowed to change and copy the source of the classes, as long as you keep
+ * the copyright notice intact and as long as you document the changes you made.
+ *
+ * You are not allowed to sell the EA classlib package or a modified version
+ * thereof, but you may charge for costs of distribution media.
+ *
+ * --------------------------------------------------------------------------
+ * Change-Log:
+ *
+ * $Log$
+ *
+ * -------------------------------------------------------------------------- */
+
+#ifndef _ICURSOR_H
+  #define _ICURSOR_H
+
+  #define forCursor(c) for ((c).setToFirst(); (c).isValid(); (c).setToNext())
+#endif
@@ -0,0 +1,163 @@
+/* --------------------------------------------------------------------------
+ * $RCSfile$
+ * $Revision$
+ * $Date$
+ * $Author$
+ * --------------------------------------------------------------------------
+ * Synopsis:
+ *
+ * Linux replacement for iexcbase.hpp of the IBM class libraries: the class
+ * IException, the exception classes derived from it and the macros ITHROW,
+ * IRETHROW and IASSERT.
+ *
+ * As in the original, an exception holds a stack of texts (text(0) is the
+ * text added last) and the locations it was thrown from. IASSERT only checks
+ * its expression if IC_DEVELOP is defined.
+ *
+ * This file is part of the EA classlib package.
+ * Copyright Bernhard Bablok, 1996
+ *
+ * The EA classlib package is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You may use the classes in the package to any extend you wish. You are
+ * allowed to change and copy the source of the classes, as long as you keep
+ * the copyright notice intact and as long as you document the changes you made.
+ *
+ * You are not allowed to sell the EA classlib package or a modified version
+ * thereof, but you may charge for costs of distribution media.
+ *
+ * --------------------------------------------------------------------------
+ * Change-Log:
+ *
+ * $Log$
+ *
+ * -------------------------------------------------------------------------- */
+
+#ifndef _IEXCBASE_
+  #define _IEXCBASE_
+
+  #include <string>
+  #include <vector>
+
+  #ifndef _ISYNONYM_
+     #include <isynonym.hpp>
+  #endif
+
+  class IExceptionLocation {
+
+     public:
+
+        IExceptionLocation(const char* fileName=0, const char* functionName=0,
+                           unsigned long lineNumber=0) :
+           mFileName(fileName), mFunctionName(functionName),
+           mLineNumber(lineNumber) {}
+
+        const char*   fileName() const {return mFileName;}
+        const char*   functionName() const {return mFunctionName;}
+        unsigned long lineNumber() const {return mLineNumber;}
+
+     private:
+
+        const char    *mFileName, *mFunctionName;
+        unsigned long mLineNumber;
+  };
+
+  class IException {
+
+     public:
+
+        enum Severity {unrecoverable, recoverable};
+
+        // constructors, destructor   ------------------------------------------
+
+        IException(const char* errorText, unsigned long errorId=0,
+                   Severity severity=IException::unrecoverable);
+        virtual ~IException() {}
+
+        // texts, id and severity   --------------------------------------------
+
+        IException&   setText(const char* errorText);
+        IException&   appendText(const char* errorText);
+        const char*   text(unsigned long indexFromTop=0) const;
+        unsigned long textCount() const {return mTexts.size();}
+
+        IException&   setErrorId(unsigned long errorId) {
+           mErrorId = errorId;
+           return *this;
+        }
+        unsigned long errorId() const {return mErrorId;}
+
+        IException&   setSeverity(Severity severity) {
+           mSeverity = severity;
+           return *this;
+        }
+        Boolean       isRecoverable() const {return mSeverity == recoverable;}
+
+        // locations   ---------------------------------------------------------
+
+        virtual IException& addLocation(const IExceptionLocation& location);
+        unsigned long locationCount() const {return mLocations.size();}
+        const IExceptionLocation*
+                      locationAtIndex(unsigned long index) const;
+
+        virtual const char* name() const {return "IException";}
+
+     private:
+
+        std::vector<std::string>        mTexts;
+        std::vector<IExceptionLocation> mLocations;
+        unsigned long                   mErrorId;
+        Severity                        mSeverity;
+  };
+
+  // derived classes   ---------------------------------------------------------
+
+  #define IEXCLASSDECLARE(child,parent)                                       \
+     class child : public parent {                                            \
+        public:                                                               \
+           child(const char* errorText, unsigned long errorId=0,              \
+                 IException::Severity severity=IException::unrecoverable) :   \
+              parent(errorText,errorId,severity) {}                           \
+           virtual const char* name() const {return #child;}                  \
+     }
+
+  IEXCLASSDECLARE(IAccessError,IException);
+  IEXCLASSDECLARE(IAssertionFailure,IException);
+  IEXCLASSDECLARE(IDeviceError,IException);
+  IEXCLASSDECLARE(IInvalidParameter,IException);
+  IEXCLASSDECLARE(IInvalidRequest,IException);
+  IEXCLASSDECLARE(IResourceExhausted,IException);
+  IEXCLASSDECLARE(IOutOfMemory,IResourceExhausted);
+
+  // macros   ------------------------------------------------------------------
+
+  #define IEXCEPTION_LOCATION() \
+                           IExceptionLocation(__FILE__,__FUNCTION__,__LINE__)
+
+  #define ITHROW(exc)                                                         \
+     do {                                                                     \
+        (exc).addLocation(IEXCEPTION_LOCATION());                             \
+        throw (exc);                                                          \
+     } while (0)
+
+  #define IRETHROW(exc)                                                       \
+     do {                                                                     \
+        (exc).addLocation(IEXCEPTION_LOCATION());                             \
+        throw;                                                                \
+     } while (0)
+
+  #ifdef IC_DEVELOP
+     #define IASSERT(test)                                                    \
+        do {                                                                  \
+           if (!(test)) {                                                     \
+              IAssertionFailure exc("The following expression must be "     \
+                                    "true, but evaluated to false: " #test); \
+              ITHROW(exc);                                                    \
+           }                                                                  \
+        } while (0)
+  #else
+     #define IASSERT(test) ((void) 0)
+  #endif
+#endif
@@ -0,0 +1,88 @@
+/* --------------------------------------------------------------------------
+ * $RCSfile$
+ * $Revision$
+ * $Date$
+ * $Author$
+ * --------------------------------------------------------------------------
+ * Synopsis:
+ *
+ * Implementation of the Linux replacements of IException and
+ * ISystemErrorInfo.
+ *
+ * This file is part of the EA classlib package.
+ * Copyright Bernhard Bablok, 1996
+ *
+ * The EA classlib package is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You may use the classes in the package to any extend you wish. You are
+ * allowed to change and copy the source of the classes, as long as you keep
+ * the copyright notice intact and as long as you document the changes you made.
+ *
+ * You are not allowed to sell the EA classlib package or a modified version
+ * thereof, but you may charge for costs of distribution media.
+ *
+ * --------------------------------------------------------------------------
+ * Change-Log:
+ *
+ * $Log$
+ *
+ * -------------------------------------------------------------------------- */
+
+#include <string.h>
+
+#ifndef _IEXCEPT_
+   #include <iexcept.hpp>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+//  IException
+//
+IException::IException(const char* errorText, unsigned long errorId,
+                       Severity severity) :
+                                   mErrorId(errorId), mSeverity(severity) {
+   mTexts.push_back(errorText ? errorText : "");
+}
+
+IException& IException::setText(const char* errorText) {
+   mTexts.back() = errorText ? errorText : "";
+   return *this;
+}
+
+IException& IException::appendText(const char* errorText) {
+   mTexts.push_back(errorText ? errorText : "");
+   return *this;
+}
+
+const char* IException::text(unsigned long indexFromTop) const {
+   if (indexFromTop >= mTexts.size())
+      return 0;
+   return mTexts[mTexts.size()-1-indexFromTop].c_str();
+}
+
+IException& IException::addLocation(const IExceptionLocation& location) {
+   mLocations.push_back(location);
+   return *this;
+}
+
+const IExceptionLocation*
+                  IException::locationAtIndex(unsigned long index) const {
+   if (index >= mLocations.size())
+      return 0;
+   return &mLocations[index];
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+//  ISystemErrorInfo: "name: text of the error"
+//
+ISystemErrorInfo::ISystemErrorInfo(unsigned long systemFunctionReturnCode,
+                                   const char* systemFunctionName) :
+                                         mErrorId(systemFunctionReturnCode) {
+   if (systemFunctionName) {
+      mText = systemFunctionName;
+      mText += ": ";
+   }
+   mText += strerror((int) systemFunctionReturnCode);
+}
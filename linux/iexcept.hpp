@@ -0,0 +1,60 @@
+/* --------------------------------------------------------------------------
+ * $RCSfile$
+ * $Revision$
+ * $Date$
+ * $Author$
+ * --------------------------------------------------------------------------
+ * Synopsis:
+ *
+ * Linux replacement for iexcept.hpp of the IBM class libraries: the
+ * exception classes (see iexcbase.hpp) and ISystemErrorInfo, which holds the
+ * text of an error number of the C library (errno).
+ *
+ * This file is part of the EA classlib package.
+ * Copyright Bernhard Bablok, 1996
+ *
+ * The EA classlib package is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You may use the classes in the package to any extend you wish. You are
+ * allowed to change and copy the source of the classes, as long as you keep
+ * the copyright notice intact and as long as you document the changes you made.
+ *
+ * You are not allowed to sell the EA classlib package or a modified version
+ * thereof, but you may charge for costs of distribution media.
+ *
+ * --------------------------------------------------------------------------
+ * Change-Log:
+ *
+ * $Log$
+ *
+ * -------------------------------------------------------------------------- */
+
+#ifndef _IEXCEPT_
+  #define _IEXCEPT_
+
+  #include <string>
+
+  #ifndef _IEXCBASE_
+     #include <iexcbase.hpp>
+  #endif
+
+  class ISystemErrorInfo {
+
+     public:
+
+        ISystemErrorInfo(unsigned long systemFunctionReturnCode,
+                         const char* systemFunctionName=0);
+
+        operator const char*() const {return mText.c_str();}
+        const char*   text() const {return mText.c_str();}
+        unsigned long errorId() const {return mErrorId;}
+        Boolean       isAvailable() const {return true;}
+
+     private:
+
+        unsigned long mErrorId;
+        std::string   mText;
+  };
+#endif
@@ -0,0 +1,257 @@
+/* --------------------------------------------------------------------------
+ * $RCSfile$
+ * $Revision$
+ * $Date$
+ * $Author$
+ * --------------------------------------------------------------------------
+ * Synopsis:
+ *
+ * Linux replacement for the class IGKeySortedSet of the IBM Open Class
+ * collections. Only the part of the interface used by the EA classlib
+ * package is provided.
+ *
+ * The elements are kept in a vector sorted by key, lookups use a binary
+ * search. The element operations class must provide key(element) and
+ * keyOps.compare(key1,key2), as in the original. As in the original, adding
+ * or removing elements invalidates all cursors of the set (except the cursor
+ * passed to the call).
+ *
+ * This file is part of the EA classlib package.
+ * Copyright Bernhard Bablok, 1996
+ *
+ * The EA classlib package is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You may use the classes in the package to any extend you wish. You are
+ * allowed to change and copy the source of the classes, as long as you keep
+ * the copyright notice intact and as long as you document the changes you made.
+ *
+ * You are not allowed to sell the EA classlib package or a modified version
+ * thereof, but you may charge for costs of distribution media.
+ *
+ * --------------------------------------------------------------------------
+ * Change-Log:
+ *
+ * $Log$
+ *
+ * -------------------------------------------------------------------------- */
+
+#ifndef _IKSSET_H
+  #define _IKSSET_H
+
+  #include <vector>
+
+  #ifndef _ICURSOR_H
+     #include <icursor.h>
+  #endif
+  #ifndef _IEXCBASE_
+     #include <iexcbase.hpp>
+  #endif
+
+  IEXCLASSDECLARE(INotContainsKeyException,IException);
+  IEXCLASSDECLARE(ICursorInvalidException,IException);
+  IEXCLASSDECLARE(IEmptyException,IException);
+
+  // base classes of element operations   --------------------------------------
+
+  class IStdMemOps {};
+
+  template <class Element> class IStdAsOps {};
+
+  // the set   -----------------------------------------------------------------
+
+  template <class Element, class Key, class ElementOps>
+  class IGKeySortedSet {
+
+     public:
+
+        typedef unsigned long INumber;
+
+        class Cursor {
+           public:
+              Cursor(const IGKeySortedSet& collection) :
+                                   mCollection(&collection), mIndex(INVALID) {}
+
+              Boolean setToFirst() {
+                 mIndex = mCollection->mElements.empty() ? INVALID : 0;
+                 return isValid();
+              }
+              Boolean setToNext() {
+                 if (isValid() && ++mIndex >= mCollection->mElements.size())
+                    mIndex = INVALID;
+                 return isValid();
+              }
+              Boolean setToLast() {
+                 mIndex = mCollection->mElements.size() - 1;
+                 return isValid();
+              }
+              Boolean setToPrevious() {
+                 if (isValid())
+                    mIndex = mIndex ? mIndex - 1 : INVALID;
+                 return isValid();
+              }
+              Boolean isValid() const {return mIndex != INVALID;}
+              void    invalidate() {mIndex = INVALID;}
+              Boolean isFor(const IGKeySortedSet& collection) const {
+                 return mCollection == &collection;
+              }
+              Element const& element() const {
+                 return mCollection->elementAt(*this);
+              }
+
+           private:
+              enum {INVALID = ~0UL};
+              friend class IGKeySortedSet;
+              const IGKeySortedSet *mCollection;
+              unsigned long        mIndex;
+        };
+
+        // constructors   ------------------------------------------------------
+
+        IGKeySortedSet(INumber numberOfElements=100) {
+           mElements.reserve(numberOfElements);
+        }
+
+        // adding and removing   -----------------------------------------------
+
+        Boolean add(Element const& element) {
+           unsigned long index;
+           if (find(mOps.key(element),index))
+              return false;
+           mElements.insert(mElements.begin()+index,element);
+           return true;
+        }
+        Boolean add(Element const& element, Cursor& cursor) {
+           unsigned long index;
+           Boolean added = !find(mOps.key(element),index);
+           if (added)
+              mElements.insert(mElements.begin()+index,element);
+           cursor.mIndex = index;
+           return added;
+        }
+        Boolean addOrReplaceElementWithKey(Element const& element) {
+           unsigned long index;
+           if (find(mOps.key(element),index)) {
+              mElements[index] = element;
+              return false;
+           }
+           mElements.insert(mElements.begin()+index,element);
+           return true;
+        }
+        Boolean replaceElementWithKey(Element const& element) {
+           unsigned long index;
+           if (!find(mOps.key(element),index))
+              return false;
+           mElements[index] = element;
+           return true;
+        }
+        Boolean removeElementWithKey(Key const& key) {
+           unsigned long index;
+           if (!find(key,index))
+              return false;
+           mElements.erase(mElements.begin()+index);
+           return true;
+        }
+        void removeAt(Cursor& cursor) {
+           checkCursor(cursor);
+           mElements.erase(mElements.begin()+cursor.mIndex);
+           cursor.invalidate();
+        }
+        void addAllFrom(IGKeySortedSet const& collection) {
+           for (unsigned long i=0; i<collection.mElements.size(); ++i)
+              add(collection.mElements[i]);
+        }
+        void removeAll() {mElements.clear();}
+
+        // lookup   ------------------------------------------------------------
+
+        Boolean containsElementWithKey(Key const& key) const {
+           unsigned long index;
+           return find(key,index);
+        }
+        Boolean locateElementWithKey(Key const& key, Cursor& cursor) const {
+           unsigned long index;
+           if (find(key,index))
+              cursor.mIndex = index;
+           else
+              cursor.invalidate();
+           return cursor.isValid();
+        }
+        Element& elementWithKey(Key const& key) {
+           return mElements[indexOf(key)];
+        }
+        Element const& elementWithKey(Key const& key) const {
+           return mElements[indexOf(key)];
+        }
+        Element& elementAt(Cursor const& cursor) {
+           checkCursor(cursor);
+           return mElements[cursor.mIndex];
+        }
+        Element const& elementAt(Cursor const& cursor) const {
+           checkCursor(cursor);
+           return mElements[cursor.mIndex];
+        }
+        Element const& anyElement() const {
+           return firstElement();
+        }
+        Element const& firstElement() const {
+           checkNotEmpty();
+           return mElements.front();
+        }
+        Element const& lastElement() const {
+           checkNotEmpty();
+           return mElements.back();
+        }
+
+        // queries   -----------------------------------------------------------
+
+        INumber numberOfElements() const {return mElements.size();}
+        Boolean isEmpty() const {return mElements.empty();}
+        Cursor* newCursor() const {return new Cursor(*this);}
+
+     private:
+
+        // binary search: index of key or index to insert key at
+        Boolean find(Key const& key, unsigned long& index) const {
+           unsigned long low = 0, high = mElements.size();
+           while (low < high) {
+              unsigned long mid = (low + high) / 2;
+              long rc = mOps.keyOps.compare(mOps.key(mElements[mid]),key);
+              if (!rc) {
+                 index = mid;
+                 return true;
+              } else if (rc < 0)
+                 low = mid + 1;
+              else
+                 high = mid;
+           }
+           index = low;
+           return false;
+        }
+        unsigned long indexOf(Key const& key) const {
+           unsigned long index;
+           if (!find(key,index)) {
+              INotContainsKeyException exc("key is not contained");
+              ITHROW(exc);
+           }
+           return index;
+        }
+        void checkNotEmpty() const {
+           if (mElements.empty()) {
+              IEmptyException exc("collection is empty");
+              ITHROW(exc);
+           }
+        }
+        void checkCursor(Cursor const& cursor) const {
+           if (!cursor.isFor(*this) || !cursor.isValid() ||
+                                     cursor.mIndex >= mElements.size()) {
+              ICursorInvalidException exc("cursor is not valid");
+              ITHROW(exc);
+           }
+        }
+
+        std::vector<Element> mElements;
+        ElementOps           mOps;
+  };
+#endif
@@ -0,0 +1,62 @@
+/* --------------------------------------------------------------------------
+ * $RCSfile$
+ * $Revision$
+ * $Date$
+ * $Author$
+ * --------------------------------------------------------------------------
+ * Synopsis:
+ *
+ * Implementation of the Linux replacement of class IMessageText.
+ *
+ * This file is part of the EA classlib package.
+ * Copyright Bernhard Bablok, 1996
+ *
+ * The EA classlib package is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You may use the classes in the package to any extend you wish. You are
+ * allowed to change and copy the source of the classes, as long as you keep
+ * the copyright notice intact and as long as you document the changes you made.
+ *
+ * You are not allowed to sell the EA classlib package or a modified version
+ * thereof, but you may charge for costs of distribution media.
+ *
+ * --------------------------------------------------------------------------
+ * Change-Log:
+ *
+ * $Log$
+ *
+ * -------------------------------------------------------------------------- */
+
+#include <stdio.h>
+
+#ifndef _IMSGTEXT_
+   #include <imsgtext.hpp>
+#endif
+
+// table of messages, generated by the makefile   ----------------------------
+
+static const struct {
+   unsigned long id;
+   const char    *text;
+} messages[] = {
+   #include "imsgtext.inc"
+   {0, 0}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+//  Look up the message
+//
+IMessageText::IMessageText(unsigned long messageId,
+                           const char* messageFileName) {
+   for (int i=0; messages[i].text; ++i)
+      if (messages[i].id == messageId) {
+         mText = messages[i].text;
+         return;
+      }
+   char buffer[128];
+   snprintf(buffer,sizeof(buffer),"Message %lu not found in %s",messageId,
+            messageFileName ? messageFileName : "message table");
+   mText = buffer;
+}
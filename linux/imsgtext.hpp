@@ -0,0 +1,56 @@
+/* --------------------------------------------------------------------------
+ * $RCSfile$
+ * $Revision$
+ * $Date$
+ * $Author$
+ * --------------------------------------------------------------------------
+ * Synopsis:
+ *
+ * Linux replacement for the class IMessageText of the IBM class libraries.
+ *
+ * Linux has no OS/2 message files: the messages are compiled into the
+ * library. The makefile generates the table of messages (imsgtext.inc) from
+ * the source of the message file (EALerr.eng or EALerr.ger), so the name of
+ * the message file is only used in the text for a missing message.
+ * Inserts (%1 ... %9) are not supported.
+ *
+ * This file is part of the EA classlib package.
+ * Copyright Bernhard Bablok, 1996
+ *
+ * The EA classlib package is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You may use the classes in the package to any extend you wish. You are
+ * allowed to change and copy the source of the classes, as long as you keep
+ * the copyright notice intact and as long as you document the changes you made.
+ *
+ * You are not allowed to sell the EA classlib package or a modified version
+ * thereof, but you may charge for costs of distribution media.
+ *
+ * --------------------------------------------------------------------------
+ * Change-Log:
+ *
+ * $Log$
+ *
+ * -------------------------------------------------------------------------- */
+
+#ifndef _IMSGTEXT_
+  #define _IMSGTEXT_
+
+  #include <string>
+
+  class IMessageText {
+
+     public:
+
+        IMessageText(unsigned long messageId, const char* messageFileName=0);
+
+        operator const char*() const {return mText.c_str();}
+        const char* text() const {return mText.c_str();}
+
+     private:
+
+        std::string mText;
+  };
+#endif
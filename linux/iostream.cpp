@@ -0,0 +1,50 @@
+/* --------------------------------------------------------------------------
+ * $RCSfile$
+ * $Revision$
+ * $Date$
+ * $Author$
+ * --------------------------------------------------------------------------
+ * Synopsis:
+ *
+ * The objects cin, cout and cerr of the Linux replacement of iostream.h.
+ * They share the buffers of the standard streams.
+ *
+ * This file is part of the EA classlib package.
+ * Copyright Bernhard Bablok, 1996
+ *
+ * The EA classlib package is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You may use the classes in the package to any extend you wish. You are
+ * allowed to change and copy the source of the classes, as long as you keep
+ * the copyright notice intact and as long as you document the changes you made.
+ *
+ * You are not allowed to sell the EA classlib package or a modified version
+ * thereof, but you may charge for costs of distribution media.
+ *
+ * --------------------------------------------------------------------------
+ * Change-Log:
+ *
+ * $Log$
+ *
+ * -------------------------------------------------------------------------- */
+
+#include <iostream>                    // initializes the standard streams
+
+#ifndef __iostream_h
+   #include <iostream.h>
+#endif
+
+istream cin(std::cin.rdbuf());
+ostream cout(std::cout.rdbuf());
+ostream cerr(std::cerr.rdbuf());
+
+// cin flushes cout (prompts), cerr is unbuffered   --------------------------
+
+static struct StreamSetup {
+   StreamSetup() {
+      cin.tie(&cout);
+      cerr.setf(std::ios_base::unitbuf);
+   }
+} streamSetup;
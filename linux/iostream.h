@@ -0,0 +1,75 @@
+/* --------------------------------------------------------------------------
+ * $RCSfile$
+ * $Revision$
+ * $Date$
+ * $Author$
+ * --------------------------------------------------------------------------
+ * Synopsis:
+ *
+ * Linux replacement for the pre-standard iostream.h of VisualAge C++.
+ *
+ * The classes ios, istream, ostream and iostream and the objects cin, cout
+ * and cerr are defined in the global namespace (EAList.hpp declares
+ * "class ostream;"), on top of the standard streams. ios::bin is the
+ * VisualAge name of ios::binary.
+ *
+ * This file is part of the EA classlib package.
+ * Copyright Bernhard Bablok, 1996
+ *
+ * The EA classlib package is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You may use the classes in the package to any extend you wish. You are
+ * allowed to change and copy the source of the classes, as long as you keep
+ * the copyright notice intact and as long as you document the changes you made.
+ *
+ * You are not allowed to sell the EA classlib package or a modified version
+ * thereof, but you may charge for costs of distribution media.
+ *
+ * --------------------------------------------------------------------------
+ * Change-Log:
+ *
+ * $Log$
+ *
+ * -------------------------------------------------------------------------- */
+
+#ifndef __iostream_h
+  #define __iostream_h
+
+  #include <istream>
+  #include <ostream>
+
+  class ios : public std::ios_base {
+     public:
+        static constexpr std::ios_base::openmode bin = std::ios_base::binary;
+     private:
+        ios();
+  };
+
+  class istream : public std::istream {
+     public:
+        istream(std::streambuf* buffer) : std::istream(buffer) {}
+  };
+
+  class ostream : public std::ostream {
+     public:
+        ostream(std::streambuf* buffer) : std::ostream(buffer) {}
+  };
+
+  class iostream : public istream, public ostream {
+     public:
+        iostream(std::streambuf* buffer) : istream(buffer), ostream(buffer) {}
+  };
+
+  extern istream cin;
+  extern ostream cout;
+  extern ostream cerr;
+
+  using std::endl;
+  using std::ends;
+  using std::flush;
+  using std::dec;
+  using std::hex;
+  using std::oct;
+#endif
@@ -0,0 +1,285 @@
+/* --------------------------------------------------------------------------
+ * $RCSfile$
+ * $Revision$
+ * $Date$
+ * $Author$
+ * --------------------------------------------------------------------------
+ * Synopsis:
+ *
+ * Implementation of the Linux replacement of class IString.
+ *
+ * This file is part of the EA classlib package.
+ * Copyright Bernhard Bablok, 1996
+ *
+ * The EA classlib package is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You may use the classes in the package to any extend you wish. You are
+ * allowed to change and copy the source of the classes, as long as you keep
+ * the copyright notice intact and as long as you document the changes you made.
+ *
+ * You are not allowed to sell the EA classlib package or a modified version
+ * thereof, but you may charge for costs of distribution media.
+ *
+ * --------------------------------------------------------------------------
+ * Change-Log:
+ *
+ * $Log$
+ *
+ * -------------------------------------------------------------------------- */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <istream>
+#include <ostream>
+
+#ifndef _ISTRING_
+   #include <istring.hpp>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+//  Constructors
+//
+IString::IString(const void* pBuffer, unsigned lenBuffer, char padCharacter) {
+   if (pBuffer)
+      mString.assign((const char*) pBuffer,lenBuffer);
+   else
+      mString.assign(lenBuffer,padCharacter);
+}
+
+IString::IString(short anInteger) : mString(std::to_string(anInteger)) {}
+IString::IString(unsigned short anUnsigned) :
+                                          mString(std::to_string(anUnsigned)) {}
+IString::IString(int anInteger) : mString(std::to_string(anInteger)) {}
+IString::IString(unsigned anUnsigned) : mString(std::to_string(anUnsigned)) {}
+IString::IString(long anInteger) : mString(std::to_string(anInteger)) {}
+IString::IString(unsigned long anUnsigned) :
+                                          mString(std::to_string(anUnsigned)) {}
+
+IString::IString(double aDouble) {
+   char buffer[32];
+   snprintf(buffer,sizeof(buffer),"%g",aDouble);
+   mString = buffer;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+//  Conversions
+//
+long IString::asInt() const {
+   return strtol(mString.c_str(),NULL,10);
+}
+
+unsigned long IString::asUnsigned() const {
+   return strtoul(mString.c_str(),NULL,10);
+}
+
+double IString::asDouble() const {
+   return strtod(mString.c_str(),NULL);
+}
+
+IString IString::c2x(const IString& aString) {
+   static const char digits[] = "0123456789ABCDEF";
+   IString result;
+   result.mString.reserve(2*aString.mString.length());
+   for (unsigned i=0; i<aString.mString.length(); ++i) {
+      unsigned char c = (unsigned char) aString.mString[i];
+      result.mString += digits[c >> 4];
+      result.mString += digits[c & 0xF];
+   }
+   return result;
+}
+
+IString IString::lineFrom(std::istream& aStream, char delim) {
+   IString result;
+   std::getline(aStream,result.mString,delim);
+   return result;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+//  Queries
+//
+Boolean IString::isDigits() const {
+   if (mString.empty())
+      return false;
+   for (unsigned i=0; i<mString.length(); ++i)
+      if (!isdigit((unsigned char) mString[i]))
+         return false;
+   return true;
+}
+
+unsigned IString::indexOf(const IString& aString, unsigned startPos) const {
+   if (!startPos)
+      startPos = 1;
+   if (startPos > mString.length())
+      return 0;
+   std::string::size_type pos = mString.find(aString.mString,startPos-1);
+   return pos == std::string::npos ? 0 : pos + 1;
+}
+
+unsigned IString::indexOf(char aCharacter, unsigned startPos) const {
+   if (!startPos)
+      startPos = 1;
+   if (startPos > mString.length())
+      return 0;
+   std::string::size_type pos = mString.find(aCharacter,startPos-1);
+   return pos == std::string::npos ? 0 : pos + 1;
+}
+
+unsigned IString::lastIndexOf(char aCharacter, unsigned startPos) const {
+   if (!startPos)
+      return 0;
+   std::string::size_type pos = mString.rfind(aCharacter,startPos-1);
+   return pos == std::string::npos ? 0 : pos + 1;
+}
+
+IString IString::subString(unsigned startPos) const {
+   if (!startPos)
+      startPos = 1;
+   if (startPos > mString.length())
+      return IString();
+   return IString(mString.data()+startPos-1,mString.length()-startPos+1);
+}
+
+IString IString::subString(unsigned startPos, unsigned length,
+                                                    char padCharacter) const {
+   IString result = subString(startPos);
+   if (result.mString.length() > length)
+      result.mString.resize(length);
+   else
+      result.mString.append(length-result.mString.length(),padCharacter);
+   return result;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+//  Editing
+//
+IString& IString::upperCase() {
+   for (unsigned i=0; i<mString.length(); ++i)
+      mString[i] = (char) toupper((unsigned char) mString[i]);
+   return *this;
+}
+
+IString& IString::lowerCase() {
+   for (unsigned i=0; i<mString.length(); ++i)
+      mString[i] = (char) tolower((unsigned char) mString[i]);
+   return *this;
+}
+
+IString& IString::strip() {
+   return stripLeading().stripTrailing();
+}
+
+IString& IString::stripLeading() {
+   std::string::size_type i = 0;
+   while (i < mString.length() && isspace((unsigned char) mString[i]))
+      ++i;
+   mString.erase(0,i);
+   return *this;
+}
+
+IString& IString::stripTrailing() {
+   std::string::size_type i = mString.length();
+   while (i && isspace((unsigned char) mString[i-1]))
+      --i;
+   mString.erase(i);
+   return *this;
+}
+
+IString& IString::remove(unsigned startPos, unsigned numChars) {
+   if (!startPos)
+      startPos = 1;
+   if (startPos <= mString.length())
+      mString.erase(startPos-1,numChars);
+   return *this;
+}
+
+IString& IString::insert(const IString& aString, unsigned index,
+                                                          char padCharacter) {
+   if (index > mString.length())
+      mString.append(index-mString.length(),padCharacter);
+   mString.insert(index,aString.mString);
+   return *this;
+}
+
+IString& IString::change(const IString& aPattern, const IString& aReplacement,
+                         unsigned startPos, unsigned numChanges) {
+   if (aPattern.mString.empty())
+      return *this;
+   if (!startPos)
+      startPos = 1;
+   std::string::size_type pos = startPos - 1;
+   while (numChanges &&
+              (pos = mString.find(aPattern.mString,pos)) != std::string::npos) {
+      mString.replace(pos,aPattern.mString.length(),aReplacement.mString);
+      pos += aReplacement.mString.length();
+      --numChanges;
+   }
+   return *this;
+}
+
+IString& IString::leftJustify(unsigned newLength, char padCharacter) {
+   if (mString.length() > newLength)
+      mString.resize(newLength);
+   else
+      mString.append(newLength-mString.length(),padCharacter);
+   return *this;
+}
+
+IString& IString::rightJustify(unsigned newLength, char padCharacter) {
+   if (mString.length() > newLength)
+      mString.erase(0,mString.length()-newLength);
+   else
+      mString.insert((std::string::size_type) 0,
+                                 newLength-mString.length(),padCharacter);
+   return *this;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+//  Concatenation
+//
+IString operator+(const IString& string1, const IString& string2) {
+   IString result(string1);
+   result.mString += string2.mString;
+   return result;
+}
+
+IString operator+(const IString& aString, const char* pString) {
+   IString result(aString);
+   if (pString)
+      result.mString += pString;
+   return result;
+}
+
+IString operator+(const char* pString, const IString& aString) {
+   IString result(pString);
+   result.mString += aString.mString;
+   return result;
+}
+
+IString operator+(const IString& aString, char aCharacter) {
+   IString result(aString);
+   result.mString += aCharacter;
+   return result;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+//  Streams: write the whole string (padded to the width of the stream), read
+//  a word
+//
+std::ostream& operator<<(std::ostream& aStream, const IString& aString) {
+   return aStream << std::string((const char*) aString,aString.length());
+}
+
+std::istream& operator>>(std::istream& aStream, IString& aString) {
+   std::string word;
+   aStream >> word;
+   aString = IString(word.data(),word.length());
+   return aStream;
+}
@@ -0,0 +1,183 @@
+/* --------------------------------------------------------------------------
+ * $RCSfile$
+ * $Revision$
+ * $Date$
+ * $Author$
+ * --------------------------------------------------------------------------
+ * Synopsis:
+ *
+ * Linux replacement for the class IString of the IBM class libraries. Only
+ * the part of the interface used by the EA classlib package is provided,
+ * with the semantics of the original: positions are 1-based, a string may
+ * contain '\0' characters and the conversion to char* returns the
+ * (always terminated) buffer of the string.
+ *
+ * Unlike the original, copies do not share their buffers.
+ *
+ * This file is part of the EA classlib package.
+ * Copyright Bernhard Bablok, 1996
+ *
+ * The EA classlib package is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You may use the classes in the package to any extend you wish. You are
+ * allowed to change and copy the source of the classes, as long as you keep
+ * the copyright notice intact and as long as you document the changes you made.
+ *
+ * You are not allowed to sell the EA classlib package or a modified version
+ * thereof, but you may charge for costs of distribution media.
+ *
+ * --------------------------------------------------------------------------
+ * Change-Log:
+ *
+ * $Log$
+ *
+ * -------------------------------------------------------------------------- */
+
+#ifndef _ISTRING_
+  #define _ISTRING_
+
+  #include <limits.h>
+  #include <iosfwd>
+  #include <string>
+
+  #ifndef _ISYNONYM_
+     #include <isynonym.hpp>
+  #endif
+
+  class IString {
+
+     public:
+
+        // constructors   ------------------------------------------------------
+
+        IString() {}
+        IString(const char* pString) : mString(pString ? pString : "") {}
+        IString(const void* pBuffer, unsigned lenBuffer,
+                                                      char padCharacter=' ');
+        IString(char aCharacter) : mString(1,aCharacter) {}
+        IString(unsigned char aCharacter) : mString(1,(char) aCharacter) {}
+        IString(signed char aCharacter) : mString(1,(char) aCharacter) {}
+        IString(short anInteger);
+        IString(unsigned short anUnsigned);
+        IString(int anInteger);
+        IString(unsigned anUnsigned);
+        IString(long anInteger);
+        IString(unsigned long anUnsigned);
+        IString(double aDouble);
+
+        // conversions   -------------------------------------------------------
+
+        operator char*() const {return (char*) mString.data();}
+        long          asInt() const;
+        unsigned long asUnsigned() const;
+        double        asDouble() const;
+
+        static IString c2x(const IString& aString);
+        static IString lineFrom(std::istream& aStream, char delim='\n');
+
+        // queries   -----------------------------------------------------------
+
+        unsigned length() const {return mString.length();}
+        unsigned size() const {return mString.length();}
+        Boolean  isDigits() const;
+        Boolean  includes(const IString& aString) const {
+           return indexOf(aString) != 0;
+        }
+        unsigned indexOf(const IString& aString, unsigned startPos=1) const;
+        unsigned indexOf(char aCharacter, unsigned startPos=1) const;
+        unsigned lastIndexOf(char aCharacter, unsigned startPos=UINT_MAX) const;
+        IString  subString(unsigned startPos) const;
+        IString  subString(unsigned startPos, unsigned length,
+                                              char padCharacter=' ') const;
+
+        // editing   -----------------------------------------------------------
+
+        IString& upperCase();
+        IString& lowerCase();
+        IString& strip();
+        IString& stripLeading();
+        IString& stripTrailing();
+        IString& remove(unsigned startPos, unsigned numChars=UINT_MAX);
+        IString& insert(const IString& aString, unsigned index=0,
+                                                      char padCharacter=' ');
+        IString& change(const IString& aPattern, const IString& aReplacement,
+                        unsigned startPos=1, unsigned numChanges=UINT_MAX);
+        IString& leftJustify(unsigned newLength, char padCharacter=' ');
+        IString& rightJustify(unsigned newLength, char padCharacter=' ');
+
+        // operators   ---------------------------------------------------------
+
+        IString& operator=(const char* pString) {
+           mString = pString ? pString : "";
+           return *this;
+        }
+        IString& operator+=(const IString& aString) {
+           mString += aString.mString;
+           return *this;
+        }
+        IString& operator+=(const char* pString) {
+           if (pString)
+              mString += pString;
+           return *this;
+        }
+        IString& operator+=(char aCharacter) {
+           mString += aCharacter;
+           return *this;
+        }
+
+        friend IString operator+(const IString& string1,
+                                                    const IString& string2);
+        friend IString operator+(const IString& aString, const char* pString);
+        friend IString operator+(const char* pString, const IString& aString);
+        friend IString operator+(const IString& aString, char aCharacter);
+
+        friend int compare(const IString& string1, const IString& string2) {
+           return string1.mString.compare(string2.mString);
+        }
+
+     private:
+
+        std::string mString;
+  };
+
+  // comparisons   -------------------------------------------------------------
+
+  inline Boolean operator==(const IString& string1, const IString& string2) {
+     return !compare(string1,string2);
+  }
+  inline Boolean operator!=(const IString& string1, const IString& string2) {
+     return compare(string1,string2) != 0;
+  }
+  inline Boolean operator< (const IString& string1, const IString& string2) {
+     return compare(string1,string2) < 0;
+  }
+  inline Boolean operator<=(const IString& string1, const IString& string2) {
+     return compare(string1,string2) <= 0;
+  }
+  inline Boolean operator> (const IString& string1, const IString& string2) {
+     return compare(string1,string2) > 0;
+  }
+  inline Boolean operator>=(const IString& string1, const IString& string2) {
+     return compare(string1,string2) >= 0;
+  }
+
+  inline Boolean operator==(const IString& aString, const char* pString) {
+     return aString == IString(pString);
+  }
+  inline Boolean operator!=(const IString& aString, const char* pString) {
+     return aString != IString(pString);
+  }
+  inline Boolean operator==(const char* pString, const IString& aString) {
+     return IString(pString) == aString;
+  }
+  inline Boolean operator!=(const char* pString, const IString& aString) {
+     return IString(pString) != aString;
+  }
+
+  // streams   -----------------------------------------------------------------
+
+  std::ostream& operator<<(std::ostream& aStream, const IString& aString);
+  std::istream& operator>>(std::istream& aStream, IString& aString);
+#endif
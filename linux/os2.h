@@ -0,0 +1,145 @@
+/* --------------------------------------------------------------------------
+ * $RCSfile$
+ * $Revision$
+ * $Date$
+ * $Author$
+ * --------------------------------------------------------------------------
+ * Synopsis:
+ *
+ * Linux replacement for the part of os2.h used by the EA classlib package:
+ * the basic types, the EA structures and constants of the OS/2 toolkit and
+ * DosQueryCp(). A ULONG has 32 bits, as on OS/2, and the structures have
+ * the packing of the toolkit, so sizeof(FEA2) and sizeof(GEA2) are the same
+ * as on OS/2 (only the byte order depends on the platform).
+ *
+ * The calls of the EA API of OS/2 (DosQueryPathInfo() and friends) are not
+ * provided, EAOS2Store is not compiled on Linux (see EAStore.hpp).
+ *
+ * It also provides strcmpi() and memicmp(), which VisualAge C++ declares in
+ * string.h.
+ *
+ * This file is part of the EA classlib package.
+ * Copyright Bernhard Bablok, 1996
+ *
+ * The EA classlib package is distributed in the hope that it will be
+ * useful, but WITHOUT ANY WARRANTY; without even the implied warranty
+ * of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * You may use the classes in the package to any extend you wish. You are
+ * allowed to change and copy the source of the classes, as long as you keep
+ * the copyright notice intact and as long as you document the changes you made.
+ *
+ * You are not allowed to sell the EA classlib package or a modified version
+ * thereof, but you may charge for costs of distribution media.
+ *
+ * --------------------------------------------------------------------------
+ * Change-Log:
+ *
+ * $Log$
+ *
+ * -------------------------------------------------------------------------- */
+
+#ifndef OS2_H
+  #define OS2_H
+
+  #include <string.h>
+  #include <strings.h>
+
+  // basic types   -------------------------------------------------------------
+
+  typedef unsigned int   ULONG;                       // 32 bits, as on OS/2
+  typedef unsigned short USHORT;
+  typedef unsigned char  BYTE;
+  typedef char           CHAR;
+  typedef void*          PVOID;
+  typedef char*          PSZ;
+  typedef ULONG*         PULONG;
+  typedef ULONG          APIRET;
+  typedef ULONG          LHANDLE;
+  typedef LHANDLE        HFILE;
+
+  // EA structures   -----------------------------------------------------------
+
+  #pragma pack(1)
+
+  typedef struct _FEA2 {
+     ULONG  oNextEntryOffset;
+     BYTE   fEA;
+     BYTE   cbName;
+     USHORT cbValue;
+     CHAR   szName[1];
+  } FEA2;
+  typedef FEA2* PFEA2;
+
+  typedef struct _FEA2LIST {
+     ULONG cbList;
+     FEA2  list[1];
+  } FEA2LIST;
+  typedef FEA2LIST* PFEA2LIST;
+
+  typedef struct _GEA2 {
+     ULONG oNextEntryOffset;
+     BYTE  cbName;
+     CHAR  szName[1];
+  } GEA2;
+  typedef GEA2* PGEA2;
+
+  typedef struct _GEA2LIST {
+     ULONG cbList;
+     GEA2  list[1];
+  } GEA2LIST;
+  typedef GEA2LIST* PGEA2LIST;
+
+  typedef FEA2 DENA2;
+  typedef DENA2* PDENA2;
+
+  #pragma pack()
+
+  // EA constants   ------------------------------------------------------------
+
+  #define FEA_NEEDEA    0x80                  // fEA: critical EA
+
+  #define EAT_BINARY    0xFFFE
+  #define EAT_ASCII     0xFFFD
+  #define EAT_BITMAP    0xFFFB
+  #define EAT_METAFILE  0xFFFA
+  #define EAT_ICON      0xFFF9
+  #define EAT_EA        0xFFEE
+  #define EAT_MVMT      0xFFDF
+  #define EAT_MVST      0xFFDE
+  #define EAT_ASN1      0xFFDD
+
+  // code page   ---------------------------------------------------------------
+
+  #define ERROR_CP_NOT_MOVED 472
+
+  // Linux has no process code page: the code page is 0 (the default code
+  // page of the system, as in multi-valued EAs).
+  inline APIRET DosQueryCp(ULONG cb, PULONG codePages, PULONG cbCodePages) {
+     if (cb < sizeof(ULONG)) {
+        *cbCodePages = 0;
+        return ERROR_CP_NOT_MOVED;
+     }
+     codePages[0] = 0;
+     *cbCodePages = sizeof(ULONG);
+     return 0;
+  }
+
+  // string.h of VisualAge C++   -----------------------------------------------
+
+  inline int strcmpi(const char* string1, const char* string2) {
+     return strcasecmp(string1,string2);
+  }
+
+  inline int memicmp(const void* buffer1, const void* buffer2, size_t count) {
+     const unsigned char *p1 = (const unsigned char*) buffer1;
+     const unsigned char *p2 = (const unsigned char*) buffer2;
+     for (size_t i=0; i<count; ++i) {
+        int c1 = p1[i] >= 'A' && p1[i] <= 'Z' ? p1[i] + ('a'-'A') : p1[i];
+        int c2 = p2[i] >= 'A' && p2[i] <= 'Z' ? p2[i] + ('a'-'A') : p2[i];
+        if (c1 != c2)
+           return c1 - c2;
+     }
+     return 0;
+  }
+#endif